@@ -0,0 +1,34 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <stdio.h>
+
+#define PROBE_HISTOGRAM_BUCKETS 16
+#define LATENCY_HISTOGRAM_BUCKETS 32
+
+/*
+Errors are reported through a hook instead of printf in the data structure code.
+The default hook prints the message to stdout; setting NULL silences it.
+Building with LRU_DISABLE_ERROR_HOOK removes the calls altogether, and
+LRU_DISABLE_STATS removes every statistics counter update.
+*/
+typedef void (*LRUErrorHook)(const char* message);
+
+void lRUCacheSetErrorHook(LRUErrorHook hook);
+void lru_report_error(const char* message) __attribute__((cold, noinline));
+unsigned long long lru_now_ns(void);
+int latency_bucket(unsigned long long ns);
+
+#ifdef LRU_DISABLE_ERROR_HOOK
+#define LRU_ERROR(message) ((void) 0)
+#else
+#define LRU_ERROR(message) lru_report_error(message)
+#endif
+
+#ifdef LRU_DISABLE_STATS
+#define LRU_STAT_ADD(counter, n) ((void) 0)
+#else
+#define LRU_STAT_ADD(counter, n) ((counter) += (n))
+#endif
+
+#endif
@@ -5,18 +5,34 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "Diagnostics.h"
+
 typedef struct CacheNode {
     struct CacheNode* next;
     struct CacheNode* prev;
     int key;
     int value;
+    // Which list of a multi-list eviction policy the node is on, 0 for plain LRU
+    unsigned char segment;
 } CacheNode;
 
+/*
+One contiguous block holding every CacheNode the cache will ever need.
+Nodes are handed out front to back and never given back: once the cache is full
+every new key recycles an evicted node in place, so the slab never runs out.
+*/
+typedef struct NodeSlab {
+    int capacity;
+    int used;
+    CacheNode* nodes;
+} NodeSlab;
+
 typedef struct DLLForLRU {
     int size;
     int capacity;
     CacheNode* head;
     CacheNode* tail;
+    NodeSlab* slab;
 } DLLForLRU;
 
 typedef struct AddNewReturn {
@@ -26,12 +42,15 @@ typedef struct AddNewReturn {
 } AddNewReturn;
 
 CacheNode* initialize_CacheNode(int key, int value);
-DLLForLRU* initialize_DLLForLRU(int capacity);
-AddNewReturn* initialize_AddNewReturn(CacheNode* added, int removed_key, CacheNode* removed_node);
-AddNewReturn* add_new(DLLForLRU* dll, int key, int value);
+NodeSlab* initialize_NodeSlab(int capacity);
+DLLForLRU* initialize_DLLForLRU(int capacity, bool use_slab);
+CacheNode* acquire_CacheNode(NodeSlab* slab, int key, int value);
+bool add_new(DLLForLRU* dll, int key, int value, AddNewReturn* returned);
 void use_existing(DLLForLRU* dll, CacheNode* node);
+void detach_node(DLLForLRU* dll, CacheNode* node);
+void append_node(DLLForLRU* dll, CacheNode* node);
 void free_CacheNode(CacheNode* node);
+void free_NodeSlab(NodeSlab* slab);
 void free_DLLForLRU(DLLForLRU* dll);
-void free_AddNewReturn(AddNewReturn* returned);
 
 #endif
@@ -0,0 +1,33 @@
+#ifndef FREQUENCY_SKETCH_H
+#define FREQUENCY_SKETCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "Diagnostics.h"
+
+#define SKETCH_DEPTH 4
+#define SKETCH_MAX_COUNT 15
+
+/*
+Count-min sketch of how often keys have been seen, used by W-TinyLFU admission.
+SKETCH_DEPTH rows of small saturating counters, each row indexed by its own hash.
+The estimate is the smallest of a key's counters, so collisions only ever overcount.
+Once sample_size increments have been made every counter is halved, so old
+popularity fades out instead of pinning keys forever.
+*/
+typedef struct FrequencySketch {
+    int width;
+    int width_shift;
+    int additions;
+    int sample_size;
+    unsigned char* counters;
+} FrequencySketch;
+
+FrequencySketch* initialize_FrequencySketch(int capacity);
+void increment_frequency(FrequencySketch* sketch, int key);
+int estimate_frequency(FrequencySketch* sketch, int key);
+void free_FrequencySketch(FrequencySketch* sketch);
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef GENERIC_CACHE_H
+#define GENERIC_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "Diagnostics.h"
+
+// Chunks come in power of two size classes from 64 bytes up to 1 MB
+#define GENERIC_MIN_CLASS_SHIFT 6
+#define GENERIC_MAX_CLASS_SHIFT 20
+#define GENERIC_NUM_CLASSES (GENERIC_MAX_CLASS_SHIFT - GENERIC_MIN_CLASS_SHIFT + 1)
+// Chunk area of a block, one largest class, or less where max_bytes leaves less
+#define GENERIC_ARENA_BLOCK_SIZE (1 << 20)
+
+typedef unsigned long long (*KeyHashFn)(const void* key, size_t key_len);
+typedef bool (*KeyEqualFn)(const void* a, size_t a_len, const void* b, size_t b_len);
+
+/*
+Header of one cached entry. The key bytes and then the value bytes follow it
+inline in the same arena chunk, so a hit is one pointer away from its payload.
+A free chunk keeps the same header, linked on its class's free list.
+*/
+typedef struct GenericEntry {
+    struct GenericEntry* next;
+    struct GenericEntry* prev;
+    unsigned long long hash;
+    unsigned int key_len;
+    unsigned int value_len;
+    unsigned int offset;        // within its block's chunk area, locates the buddy chunk
+    unsigned short size_class;
+    bool is_free;
+} GenericEntry;
+
+/*
+Index slot: the low hash bits are kept as a fingerprint so most mismatches
+are rejected without touching the entry. psl works as in Map's MapSlot.
+*/
+typedef struct GenericSlot {
+    GenericEntry* entry;
+    unsigned int fingerprint;
+    int psl;
+} GenericSlot;
+
+/*
+Blocks are split into chunks buddy style: a free chunk is halved for smaller
+classes and merged with its free buddy again when a chunk is given back.
+size counts the block header, as reserved_bytes does.
+*/
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;
+} ArenaBlock;
+
+// Chunks start after the block header, kept 16 byte aligned
+#define GENERIC_BLOCK_HEADER_SIZE ((sizeof(ArenaBlock) + 15) & ~((size_t) 15))
+
+typedef struct GenericArena {
+    ArenaBlock* blocks;
+    size_t reserved_bytes;
+    size_t max_bytes;
+    GenericEntry* free_lists[GENERIC_NUM_CLASSES];
+} GenericArena;
+
+typedef struct GenericCache {
+    int max_entries;            // 0 means no entry limit
+    size_t max_bytes;           // 0 means no byte limit
+    int count;
+    size_t live_bytes;          // sum of the chunk sizes of cached entries
+    KeyHashFn hash;
+    KeyEqualFn equal;
+    GenericArena arena;
+    // Recency list, head is least recently used
+    GenericEntry* head;
+    GenericEntry* tail;
+    int table_capacity;
+    int hash_shift;
+    GenericSlot* slots;
+} GenericCache;
+
+unsigned long long generic_default_hash(const void* key, size_t key_len);
+bool generic_default_equal(const void* a, size_t a_len, const void* b, size_t b_len);
+
+GenericCache* genericCacheCreate(int max_entries, size_t max_bytes, KeyHashFn hash, KeyEqualFn equal);
+bool genericCacheGet(GenericCache* obj, const void* key, size_t key_len, const void** value, size_t* value_len);
+bool genericCachePut(GenericCache* obj, const void* key, size_t key_len, const void* value, size_t value_len);
+int genericCacheCount(GenericCache* obj);
+void genericCacheFree(GenericCache* obj);
+
+#endif
@@ -5,17 +5,86 @@
 #include <stdlib.h>
 
 #include "DoubleLinkedList.h"
+#include "FrequencySketch.h"
 #include "Map.h"
 
+// Batches are prefetched in windows of this many keys so early prefetches are not evicted before use
+#define BATCH_PREFETCH_WINDOW 32
+
+typedef enum AllocMode {
+    HEAP_ALLOC,     // nodes come from malloc as they are needed
+    SLAB_ALLOC      // every node is preallocated at create time, steady state never calls malloc/free
+} AllocMode;
+
+typedef enum EvictionPolicy {
+    LRU_POLICY,         // one list, evict the least recently used
+    SLRU_POLICY,        // segmented LRU: new keys go to probation and are promoted to protected on a hit
+    WTINYLFU_POLICY     // small LRU window, then a frequency sketch decides who gets into a segmented main
+} EvictionPolicy;
+
+// Values for CacheNode::segment
+typedef enum NodeSegment {
+    PROBATION_SEGMENT,
+    PROTECTED_SEGMENT,
+    WINDOW_SEGMENT
+} NodeSegment;
+
+typedef struct LRUCacheOptions {
+    AllocMode alloc_mode;
+    MapEngine map_engine;
+    EvictionPolicy policy;
+    // Time one get/put in this many for the latency histogram, 0 turns timing off
+    int latency_sample_every;
+} LRUCacheOptions;
+
+/*
+Snapshot returned by lRUCacheStats. Counters are plain fields updated by the
+owning cache, so a ShardedLRUCache keeps one set per shard and sums them on request.
+*/
+typedef struct LRUCacheStats {
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long inserts;         // puts of a key that was not cached
+    unsigned long long updates;         // puts that overwrote a cached key
+    unsigned long long evictions;
+    unsigned long long probe_histogram[PROBE_HISTOGRAM_BUCKETS];
+    unsigned long long latency_samples;
+    unsigned long long latency_histogram[LATENCY_HISTOGRAM_BUCKETS];
+} LRUCacheStats;
+
+/*
+dll is the only list for LRU_POLICY and the probation list for the others.
+It owns the NodeSlab, so every list allocates from dll->slab.
+*/
 typedef struct LRUCache {
     int capacity;
+    EvictionPolicy policy;
     Map* map;
     DLLForLRU* dll;
+    // Only used by SLRU_POLICY and WTINYLFU_POLICY
+    DLLForLRU* protected_dll;
+    int protected_capacity;
+    // Only used by WTINYLFU_POLICY
+    DLLForLRU* window_dll;
+    int window_capacity;
+    FrequencySketch* sketch;
+    LRUCacheStats stats;
+    int latency_sample_every;
+    int ops_until_sample;
 } LRUCache;
 
+LRUCacheOptions default_LRUCacheOptions(void);
 LRUCache* lRUCacheCreate(int capacity);
+LRUCache* lRUCacheCreateWithOptions(int capacity, LRUCacheOptions options);
 int lRUCacheGet(LRUCache* obj, int key);
+void lRUCachePromote(LRUCache* obj, CacheNode* node);
+void lRUCacheRecordMiss(LRUCache* obj, int key);
 void lRUCachePut(LRUCache* obj, int key, int value);
+int lRUCacheSize(LRUCache* obj);
+LRUCacheStats lRUCacheStats(LRUCache* obj);
+void add_LRUCacheStats(LRUCacheStats* total, const LRUCacheStats* part);
+void lRUCacheGetBatch(LRUCache* obj, const int* keys, int n, int* out_values);
+void lRUCachePutBatch(LRUCache* obj, const int* keys, const int* values, int n);
 void lRUCacheFree(LRUCache* obj);
 
-#endif LRU_H
\ No newline at end of file
+#endif
@@ -5,26 +5,63 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "Diagnostics.h"
 #include "DoubleLinkedList.h"
 
+typedef enum MapEngine {
+    CHAINED_MAP,            // array of MapNode chains
+    OPEN_ADDRESSING_MAP     // Robin Hood table of MapSlots, keys stored inline
+} MapEngine;
+
 typedef struct MapNode{
     CacheNode* cache_node;
     struct MapNode* next;
 } MapNode;
 
+/*
+One slot of the open addressing table. Keeping the key next to the node pointer
+means a probe never has to dereference the CacheNode to compare keys.
+psl is the probe sequence length: 1 in the home slot, 0 when the slot is empty.
+*/
+typedef struct MapSlot{
+    CacheNode* cache_node;
+    int key;
+    int psl;
+} MapSlot;
+
 typedef struct Map{
+    MapEngine engine;
+    // Both engines use a power of two table and take the index from the top hash bits
     int arr_capacity;
+    int hash_shift;
     MapNode** backend_arr;
+    // Only set in slab mode: one MapNode per cache entry, recycled through free_mapnodes
+    MapNode* mapnode_slab;
+    MapNode* free_mapnodes;
+    // Only set for OPEN_ADDRESSING_MAP
+    MapSlot* slots;
+    // How many chain nodes or slots each get/find_or_insert looked at, the last bucket is "or more"
+    unsigned long long probe_histogram[PROBE_HISTOGRAM_BUCKETS];
 } Map;
 
 MapNode* initialize_MapNode(CacheNode* cache_node);
 void free_MapNode(MapNode* mapnode);
-Map* initialize_Map(int cache_capacity);
+MapNode* acquire_MapNode(Map* map, CacheNode* cache_node);
+void release_MapNode(Map* map, MapNode* mapnode);
+Map* initialize_Map(int cache_capacity, bool use_slab, MapEngine engine);
 void free_Map(Map* map);
 
+int hash_key(int key, int hash_shift);
+CacheNode** find_or_insert(Map* map, int key, bool* found);
+CacheNode** find_or_insert_hashed(Map* map, int key, int hash, bool* found);
 void add_element(Map* map, int key, CacheNode* value_node);
 void update_element(Map* map, int key, int value);
-void del_element(Map* map, CacheNode* cache_node);
+void del_element(Map* map, int key, CacheNode* cache_node);
 bool exists(Map* map, int key);
 CacheNode* get(Map* map, int key);
-#endif
\ No newline at end of file
+CacheNode* get_hashed(Map* map, int key, int hash);
+CacheNode* get_optimistic(Map* map, int key);
+int prefetch_bucket(Map* map, int key);
+void prefetch_mapnode(Map* map, int hash);
+void prefetch_node(Map* map, int hash);
+#endif
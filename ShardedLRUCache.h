@@ -0,0 +1,77 @@
+#ifndef SHARDED_LRU_H
+#define SHARDED_LRU_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "LRUCache.h"
+
+#define CACHE_LINE_SIZE 64
+#define READ_BUFFER_STRIPES 4
+#define READ_BUFFER_SIZE 16
+
+/*
+Lossy ring of hits waiting to be applied to a shard's DLLForLRU.
+Readers claim an entry by moving tail with a CAS and then publish the node into it.
+Only the drainer, holding the shard lock, reads entries and moves head.
+When the ring is full or the CAS loses, the hit is dropped: recency gets a
+little stale, but a reader never waits.
+*/
+typedef struct ReadBuffer {
+    unsigned int head;
+    unsigned int tail;
+    CacheNode* entries[READ_BUFFER_SIZE];
+} __attribute__((aligned(CACHE_LINE_SIZE))) ReadBuffer;
+
+/*
+Same lossy ring for lock-free misses, used only when the shards run WTINYLFU_POLICY
+so the frequency sketch sees misses whether or not reads are buffered.
+An entry holds the key plus one, so 0 still means "not published yet".
+*/
+typedef struct MissBuffer {
+    unsigned int head;
+    unsigned int tail;
+    unsigned long long entries[READ_BUFFER_SIZE];
+} __attribute__((aligned(CACHE_LINE_SIZE))) MissBuffer;
+
+/*
+Lock-free gets served through one stripe. Gets that fall back to the lock are
+counted by the shard's LRUCache instead. Kept off the ReadBuffer's lines so
+counting a miss never invalidates the line the ring's head and tail live on.
+*/
+typedef struct ReadStats {
+    unsigned long long hits;
+    unsigned long long misses;
+} __attribute__((aligned(CACHE_LINE_SIZE))) ReadStats;
+
+/*
+One independent LRUCache (its own Map and DLLForLRU) behind its own lock.
+Aligned so two shards never share a cache line and their locks do not false share.
+seq is a seqlock over the Map and node values: odd while a put is changing them.
+*/
+typedef struct LRUShard {
+    pthread_mutex_t lock;
+    LRUCache* cache;
+    unsigned int seq;
+    ReadBuffer read_buffers[READ_BUFFER_STRIPES];
+    MissBuffer miss_buffers[READ_BUFFER_STRIPES];
+    ReadStats read_stats[READ_BUFFER_STRIPES];
+} __attribute__((aligned(CACHE_LINE_SIZE))) LRUShard;
+
+typedef struct ShardedLRUCache {
+    int capacity;
+    int num_shards;
+    bool buffered_reads;
+    LRUShard* shards;
+} ShardedLRUCache;
+
+ShardedLRUCache* shardedLRUCacheCreate(int capacity, int num_shards, LRUCacheOptions options, bool buffered_reads);
+int shardedLRUCacheGet(ShardedLRUCache* obj, int key);
+void shardedLRUCachePut(ShardedLRUCache* obj, int key, int value);
+int shardedLRUCacheSize(ShardedLRUCache* obj);
+LRUCacheStats shardedLRUCacheStats(ShardedLRUCache* obj);
+void shardedLRUCacheFree(ShardedLRUCache* obj);
+
+#endif